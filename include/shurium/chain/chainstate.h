@@ -142,6 +142,12 @@ private:
     /// Whether this chainstate has been initialized
     std::atomic<bool> m_initialized{false};
     
+    /// Rolling UTXO set commitment at the current tip
+    UTXOCommitment m_utxoCommitment;
+    
+    /// False if the backing store had no commitment for its best block
+    bool m_hasUTXOCommitment{false};
+    
     // Internal helpers
     bool ConnectBlock(const Block& block, BlockIndex* pindex, 
                       CoinsViewCache& view, BlockUndo& blockundo);
@@ -222,6 +228,13 @@ public:
         return m_coins->GetCoin(outpoint);
     }
     
+    /// Get the UTXO set commitment at the tip (nullopt if not tracked)
+    std::optional<UTXOCommitment> GetUTXOCommitment() const {
+        std::lock_guard<std::mutex> lock(m_cs);
+        if (!m_hasUTXOCommitment) return std::nullopt;
+        return m_utxoCommitment;
+    }
+    
     // ========================================================================
     // Block Operations
     // ========================================================================
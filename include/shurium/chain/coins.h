@@ -11,8 +11,10 @@
 #include "shurium/core/types.h"
 #include "shurium/core/transaction.h"
 #include "shurium/core/serialize.h"
+#include "shurium/crypto/muhash.h"
 #include <cstdint>
 #include <unordered_map>
+#include <map>
 #include <optional>
 #include <memory>
 #include <functional>
@@ -176,6 +178,50 @@ struct CoinsCacheEntry {
 /// Type alias for the coins cache map
 using CoinsMap = std::unordered_map<OutPoint, CoinsCacheEntry, OutPointHasher>;
 
+// ============================================================================
+// UTXOCommitment - Incrementally maintained UTXO set summary
+// ============================================================================
+
+/**
+ * Rolling commitment to the UTXO set at a given block.
+ * 
+ * The MuHash is updated in O(1) per created or spent coin, so the set hash
+ * and the aggregate counters never require a scan of the coins database.
+ * One commitment is recorded per connected block.
+ */
+struct UTXOCommitment {
+    MuHash3072 muhash;                 // Multiset hash of (outpoint, coin)
+    uint64_t nTransactionOutputs{0};   // Total number of UTXOs
+    uint64_t nBogoSize{0};             // Estimate of serialized size
+    Amount nTotalAmount{0};            // Total value of all UTXOs
+    
+    /// Account for a coin entering the UTXO set
+    void AddCoin(const OutPoint& outpoint, const Coin& coin);
+    
+    /// Account for a coin leaving the UTXO set
+    void RemoveCoin(const OutPoint& outpoint, const Coin& coin);
+    
+    /// Finalize the MuHash into a 256-bit digest
+    Hash256 GetHash() const { return muhash.Finalize(); }
+};
+
+/// Serialization for UTXOCommitment
+template<typename Stream>
+void Serialize(Stream& s, const UTXOCommitment& commitment) {
+    Serialize(s, commitment.muhash);
+    Serialize(s, commitment.nTransactionOutputs);
+    Serialize(s, commitment.nBogoSize);
+    Serialize(s, commitment.nTotalAmount);
+}
+
+template<typename Stream>
+void Unserialize(Stream& s, UTXOCommitment& commitment) {
+    Unserialize(s, commitment.muhash);
+    Unserialize(s, commitment.nTransactionOutputs);
+    Unserialize(s, commitment.nBogoSize);
+    Unserialize(s, commitment.nTotalAmount);
+}
+
 // ============================================================================
 // CoinsView - Abstract interface for UTXO database views
 // ============================================================================
@@ -202,6 +248,16 @@ public:
     
     /// Get estimated size of the UTXO set
     virtual size_t EstimateSize() const { return 0; }
+    
+    /// Get the UTXO commitment recorded for a block, if any
+    virtual std::optional<UTXOCommitment> GetUTXOCommitment(const BlockHash& block) const {
+        return std::nullopt;
+    }
+    
+    /// Record the UTXO commitment for a block
+    virtual bool WriteUTXOCommitment(const BlockHash& block, const UTXOCommitment& commitment) {
+        return false;
+    }
 };
 
 // ============================================================================
@@ -235,6 +291,14 @@ public:
         return base ? base->EstimateSize() : 0;
     }
     
+    std::optional<UTXOCommitment> GetUTXOCommitment(const BlockHash& block) const override {
+        return base ? base->GetUTXOCommitment(block) : std::nullopt;
+    }
+    
+    bool WriteUTXOCommitment(const BlockHash& block, const UTXOCommitment& commitment) override {
+        return base ? base->WriteUTXOCommitment(block, commitment) : false;
+    }
+    
     void SetBackend(CoinsView* viewIn) { base = viewIn; }
     CoinsView* GetBackend() const { return base; }
 };
@@ -322,6 +386,7 @@ class CoinsViewMemory : public CoinsView {
 private:
     CoinsMap coins;
     BlockHash bestBlock;
+    std::map<BlockHash, UTXOCommitment> commitments;
     
 public:
     CoinsViewMemory() = default;
@@ -330,6 +395,8 @@ public:
     bool HaveCoin(const OutPoint& outpoint) const override;
     BlockHash GetBestBlock() const override;
     size_t EstimateSize() const override;
+    std::optional<UTXOCommitment> GetUTXOCommitment(const BlockHash& block) const override;
+    bool WriteUTXOCommitment(const BlockHash& block, const UTXOCommitment& commitment) override;
     
     /// Direct manipulation for testing
     void AddCoin(const OutPoint& outpoint, const Coin& coin);
@@ -354,6 +421,7 @@ struct UTXOStats {
     uint64_t nBogoSize{0};         // Estimate of serialized size
     Amount nTotalAmount{0};        // Total value of all UTXOs
     Hash256 hashSerialized;        // Hash of the entire UTXO set
+    Hash256 hashMuHash;            // MuHash3072 digest of the UTXO set
     uint64_t nDiskSize{0};         // Size on disk
     
     void Reset() {
@@ -362,6 +430,7 @@ struct UTXOStats {
         nBogoSize = 0;
         nTotalAmount = 0;
         hashSerialized.SetNull();
+        hashMuHash.SetNull();
         nDiskSize = 0;
     }
 };
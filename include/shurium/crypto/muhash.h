@@ -0,0 +1,127 @@
+// SHURIUM - MuHash3072 Rolling Set Hash
+// Copyright (c) 2024 SHURIUM Developers
+// MIT License
+//
+// Multiplicative multiset hash over the prime field 2^3072 - 1103717.
+// Elements can be added and removed in O(1) and in any order, which lets
+// the UTXO set commitment be maintained incrementally as blocks connect
+// and disconnect instead of being recomputed from a full database scan.
+
+#ifndef SHURIUM_CRYPTO_MUHASH_H
+#define SHURIUM_CRYPTO_MUHASH_H
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include "shurium/core/types.h"
+#include "shurium/core/serialize.h"
+
+namespace shurium {
+
+// ============================================================================
+// 3072-bit Field Element
+// ============================================================================
+
+/// Element of the field modulo 2^3072 - 1103717 as 48 x 64-bit limbs
+/// (little-endian). Values are kept below 2^3072 but are only fully
+/// reduced below the modulus when converted to bytes.
+class Num3072 {
+public:
+    static constexpr size_t NUM_LIMBS = 48;
+    static constexpr size_t BYTE_SIZE = NUM_LIMBS * 8;
+
+    /// Limbs in little-endian order (limbs[0] is least significant)
+    std::array<uint64_t, NUM_LIMBS> limbs;
+
+    /// Default constructor - the multiplicative identity
+    Num3072() { SetToOne(); }
+
+    /// Construct from 384 little-endian bytes
+    explicit Num3072(const Byte (&data)[BYTE_SIZE]);
+
+    /// Set to the multiplicative identity
+    void SetToOne();
+
+    /// this = this * a (mod p)
+    void Multiply(const Num3072& a);
+
+    /// this = this / a (mod p)
+    void Divide(const Num3072& a);
+
+    /// Compute the multiplicative inverse (mod p)
+    Num3072 GetInverse() const;
+
+    /// Serialize the fully reduced value as 384 little-endian bytes
+    void ToBytes(Byte (&out)[BYTE_SIZE]) const;
+
+private:
+    /// Check whether the value is >= the modulus
+    bool IsOverflow() const;
+
+    /// Subtract the modulus once (requires IsOverflow())
+    void FullReduce();
+};
+
+// ============================================================================
+// MuHash3072
+// ============================================================================
+
+/**
+ * Rolling hash of a multiset of byte strings.
+ *
+ * Each element is mapped to a field element; the set hash is the product of
+ * inserted elements divided by the product of removed ones. Insertion and
+ * removal commute, so the result only depends on the final multiset.
+ * Division is deferred to Finalize() by tracking numerator and denominator
+ * separately, keeping Insert/Remove to a single field multiplication.
+ */
+class MuHash3072 {
+public:
+    /// Create a hash of the empty set
+    MuHash3072() = default;
+
+    /// Create a hash of the set containing a single element
+    MuHash3072(const Byte* data, size_t len);
+
+    /// Add an element to the set
+    MuHash3072& Insert(const Byte* data, size_t len);
+
+    /// Remove an element from the set
+    MuHash3072& Remove(const Byte* data, size_t len);
+
+    /// Multiset union
+    MuHash3072& operator*=(const MuHash3072& mul);
+
+    /// Multiset difference
+    MuHash3072& operator/=(const MuHash3072& div);
+
+    /// Compute the 256-bit digest of the set. Costs one field inversion.
+    Hash256 Finalize() const;
+
+    /// Compare set contents (cross-multiplied, no inversion needed)
+    bool operator==(const MuHash3072& other) const;
+    bool operator!=(const MuHash3072& other) const { return !(*this == other); }
+
+    template<typename Stream>
+    friend void Serialize(Stream& s, const MuHash3072& muhash) {
+        Serialize(s, muhash.numerator_.limbs);
+        Serialize(s, muhash.denominator_.limbs);
+    }
+
+    template<typename Stream>
+    friend void Unserialize(Stream& s, MuHash3072& muhash) {
+        Unserialize(s, muhash.numerator_.limbs);
+        Unserialize(s, muhash.denominator_.limbs);
+    }
+
+private:
+    Num3072 numerator_;
+    Num3072 denominator_;
+
+    /// Map arbitrary data to a field element
+    static Num3072 ToNum3072(const Byte* data, size_t len);
+};
+
+} // namespace shurium
+
+#endif // SHURIUM_CRYPTO_MUHASH_H
@@ -420,6 +420,7 @@ namespace prefix {
     // UTXO set
     constexpr char COIN = 'C';            // outpoint -> coin
     constexpr char COINS_TIP = 'c';       // -> best block hash for coins
+    constexpr char UTXO_COMMITMENT = 'm'; // block hash -> UTXO set commitment
     
     // Transaction index
     constexpr char TX_INDEX = 't';        // txid -> block location
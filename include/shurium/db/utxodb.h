@@ -71,6 +71,8 @@ public:
     bool HaveCoin(const OutPoint& outpoint) const override;
     BlockHash GetBestBlock() const override;
     size_t EstimateSize() const override;
+    std::optional<UTXOCommitment> GetUTXOCommitment(const BlockHash& block) const override;
+    bool WriteUTXOCommitment(const BlockHash& block, const UTXOCommitment& commitment) override;
     
     // ========================================================================
     // Write Operations
@@ -210,7 +212,18 @@ public:
 Hash256 CalculateUTXOSetHash(const CoinsViewDB& coinsView);
 
 /**
- * Get comprehensive UTXO statistics.
+ * Calculate the MuHash3072 of the entire UTXO set by a full scan.
+ * Used to verify the incrementally maintained UTXOCommitment.
+ * 
+ * @param coinsView The coins view to hash
+ * @return Rolling hash of the UTXO set
+ */
+MuHash3072 CalculateUTXOSetMuHash(const CoinsViewDB& coinsView);
+
+/**
+ * Get comprehensive UTXO statistics by scanning the whole set.
+ * Prefer the O(1) GetUTXOStats(const CoinsView&) when a commitment
+ * for the best block is available.
  */
 UTXOStats GetUTXOStats(const CoinsViewDB& coinsView);
 
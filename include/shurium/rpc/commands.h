@@ -202,6 +202,10 @@ RPCResponse cmd_getchaintips(const RPCRequest& req, const RPCContext& ctx,
 RPCResponse cmd_getdifficulty(const RPCRequest& req, const RPCContext& ctx,
                               RPCCommandTable* table);
 
+/// Get UTXO set statistics (served from the rolling UTXO commitment)
+RPCResponse cmd_gettxoutsetinfo(const RPCRequest& req, const RPCContext& ctx,
+                                RPCCommandTable* table);
+
 /// Get mempool info
 RPCResponse cmd_getmempoolinfo(const RPCRequest& req, const RPCContext& ctx,
                                RPCCommandTable* table);
@@ -63,6 +63,55 @@ static bool VerifyTransactionScripts(const Transaction& tx,
     return true;
 }
 
+// ============================================================================
+// UTXO Commitment Helper
+// ============================================================================
+
+/**
+ * Apply a block's UTXO changes to a rolling commitment.
+ * 
+ * Spent coins come from the undo data and created coins from the block's
+ * outputs, so the update costs O(inputs + outputs) regardless of set size.
+ * 
+ * @param commitment The commitment to update
+ * @param block The block being connected or disconnected
+ * @param blockundo Undo data holding the coins spent by the block
+ * @param height Height of the block
+ * @param fConnect true when connecting, false when disconnecting
+ */
+static void UpdateUTXOCommitment(UTXOCommitment& commitment,
+                                 const Block& block,
+                                 const BlockUndo& blockundo,
+                                 uint32_t height,
+                                 bool fConnect) {
+    for (size_t i = 0; i < block.vtx.size(); ++i) {
+        const Transaction& tx = *block.vtx[i];
+        TxHash txhash = tx.GetHash();
+        
+        for (size_t j = 0; j < tx.vout.size(); ++j) {
+            if (tx.vout[j].IsNull()) continue;
+            OutPoint outpoint(txhash, static_cast<uint32_t>(j));
+            Coin coin(tx.vout[j], height, tx.IsCoinBase());
+            if (fConnect) {
+                commitment.AddCoin(outpoint, coin);
+            } else {
+                commitment.RemoveCoin(outpoint, coin);
+            }
+        }
+        
+        if (tx.IsCoinBase()) continue;
+        
+        const TxUndo& txundo = blockundo.vtxundo[i - 1];
+        for (size_t j = 0; j < tx.vin.size(); ++j) {
+            if (fConnect) {
+                commitment.RemoveCoin(tx.vin[j].prevout, txundo.vprevout[j]);
+            } else {
+                commitment.AddCoin(tx.vin[j].prevout, txundo.vprevout[j]);
+            }
+        }
+    }
+}
+
 // ============================================================================
 // ChainState Implementation
 // ============================================================================
@@ -85,6 +134,8 @@ bool ChainState::Initialize() {
     if (bestBlock.IsNull()) {
         // No best block - this is a fresh database
         // Initialize with genesis block if available
+        m_utxoCommitment = UTXOCommitment();
+        m_hasUTXOCommitment = true;
         m_initialized = true;
         return true;
     }
@@ -99,6 +150,18 @@ bool ChainState::Initialize() {
     // Set the chain to this tip
     m_chain.SetTip(it->second.get());
     
+    // Resume the rolling UTXO commitment from the one stored for this tip
+    auto commitment = m_coins->GetUTXOCommitment(bestBlock);
+    if (commitment) {
+        m_utxoCommitment = std::move(*commitment);
+        m_hasUTXOCommitment = true;
+    } else {
+        LOG_WARN(util::LogCategory::DEFAULT) << "No UTXO commitment stored for best block "
+                                              << bestBlock.ToHex().substr(0, 16)
+                                              << ", UTXO set hash unavailable until reindex";
+        m_hasUTXOCommitment = false;
+    }
+    
     m_initialized = true;
     return true;
 }
@@ -175,6 +238,12 @@ ConnectResult ChainState::ConnectBlock(const Block& block, BlockIndex* pindex,
     // Update best block
     m_coins->SetBestBlock(pindex->GetBlockHash());
     
+    // Roll the UTXO commitment forward and record it for this block
+    if (m_hasUTXOCommitment) {
+        UpdateUTXOCommitment(m_utxoCommitment, block, blockundo, pindex->nHeight, true);
+        m_coins->WriteUTXOCommitment(pindex->GetBlockHash(), m_utxoCommitment);
+    }
+    
     // Update the chain
     m_chain.SetTip(pindex);
     
@@ -270,6 +339,11 @@ ConnectResult ChainState::DisconnectTip(const Block& block, const BlockUndo& blo
         }
     }
     
+    // Roll the UTXO commitment back to the parent's state
+    if (m_hasUTXOCommitment) {
+        UpdateUTXOCommitment(m_utxoCommitment, block, blockundo, pindex->nHeight, false);
+    }
+    
     // Update best block to previous
     if (pindex->pprev) {
         m_coins->SetBestBlock(pindex->pprev->GetBlockHash());
@@ -287,12 +287,26 @@ void CoinsViewMemory::RemoveCoin(const OutPoint& outpoint) {
     coins.erase(outpoint);
 }
 
+std::optional<UTXOCommitment> CoinsViewMemory::GetUTXOCommitment(const BlockHash& block) const {
+    auto it = commitments.find(block);
+    if (it == commitments.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+bool CoinsViewMemory::WriteUTXOCommitment(const BlockHash& block, const UTXOCommitment& commitment) {
+    commitments[block] = commitment;
+    return true;
+}
+
 void CoinsViewMemory::SetBestBlock(const BlockHash& block) {
     bestBlock = block;
 }
 
 void CoinsViewMemory::Clear() {
     coins.clear();
+    commitments.clear();
     bestBlock.SetNull();
 }
 
@@ -307,15 +321,49 @@ void CoinsViewMemory::BatchWrite(CoinsMap& mapCoins, const BlockHash& block) {
     bestBlock = block;
 }
 
+// ============================================================================
+// UTXOCommitment Implementation
+// ============================================================================
+
+void UTXOCommitment::AddCoin(const OutPoint& outpoint, const Coin& coin) {
+    DataStream ss;
+    Serialize(ss, outpoint);
+    Serialize(ss, coin);
+    muhash.Insert(ss.data(), ss.size());
+    
+    ++nTransactionOutputs;
+    nBogoSize += ss.size();
+    nTotalAmount += coin.GetAmount();
+}
+
+void UTXOCommitment::RemoveCoin(const OutPoint& outpoint, const Coin& coin) {
+    DataStream ss;
+    Serialize(ss, outpoint);
+    Serialize(ss, coin);
+    muhash.Remove(ss.data(), ss.size());
+    
+    --nTransactionOutputs;
+    nBogoSize -= ss.size();
+    nTotalAmount -= coin.GetAmount();
+}
+
 // ============================================================================
 // UTXO Statistics
 // ============================================================================
 
 UTXOStats GetUTXOStats(const CoinsView& view) {
     UTXOStats stats;
-    // This is a simplified implementation
-    // Production would iterate through all UTXOs
     stats.hashSerialized.SetNull();
+    
+    // Served from the commitment recorded for the best block; views without
+    // one (or before the first block) report an empty set
+    auto commitment = view.GetUTXOCommitment(view.GetBestBlock());
+    if (commitment) {
+        stats.nTransactionOutputs = commitment->nTransactionOutputs;
+        stats.nBogoSize = commitment->nBogoSize;
+        stats.nTotalAmount = commitment->nTotalAmount;
+        stats.hashMuHash = commitment->GetHash();
+    }
     return stats;
 }
 
@@ -0,0 +1,193 @@
+// SHURIUM - MuHash3072 Implementation
+// Copyright (c) 2024 SHURIUM Developers
+// MIT License
+
+#include "shurium/crypto/muhash.h"
+#include "shurium/crypto/sha256.h"
+#include <cstring>
+
+namespace shurium {
+
+namespace {
+
+/// The modulus is 2^3072 - MAX_PRIME_DIFF
+constexpr uint64_t MAX_PRIME_DIFF = 1103717;
+
+/// Number of 32-byte hash blocks needed to fill one field element
+constexpr size_t EXPAND_BLOCKS = Num3072::BYTE_SIZE / SHA256::OUTPUT_SIZE;
+
+} // namespace
+
+// ============================================================================
+// Num3072
+// ============================================================================
+
+Num3072::Num3072(const Byte (&data)[BYTE_SIZE]) {
+    for (size_t i = 0; i < NUM_LIMBS; ++i) {
+        uint64_t limb = 0;
+        for (size_t j = 0; j < 8; ++j) {
+            limb |= static_cast<uint64_t>(data[i * 8 + j]) << (j * 8);
+        }
+        limbs[i] = limb;
+    }
+}
+
+void Num3072::SetToOne() {
+    limbs.fill(0);
+    limbs[0] = 1;
+}
+
+bool Num3072::IsOverflow() const {
+    if (limbs[0] < ~uint64_t(0) - MAX_PRIME_DIFF + 1) return false;
+    for (size_t i = 1; i < NUM_LIMBS; ++i) {
+        if (limbs[i] != ~uint64_t(0)) return false;
+    }
+    return true;
+}
+
+void Num3072::FullReduce() {
+    // this - p == this + MAX_PRIME_DIFF - 2^3072; the final carry is dropped
+    uint64_t carry = MAX_PRIME_DIFF;
+    for (size_t i = 0; i < NUM_LIMBS && carry; ++i) {
+        limbs[i] += carry;
+        carry = limbs[i] < carry ? 1 : 0;
+    }
+}
+
+void Num3072::Multiply(const Num3072& a) {
+    // Schoolbook product into a 6144-bit intermediate
+    uint64_t wide[2 * NUM_LIMBS] = {0};
+    for (size_t i = 0; i < NUM_LIMBS; ++i) {
+        uint64_t carry = 0;
+        for (size_t j = 0; j < NUM_LIMBS; ++j) {
+            __uint128_t t = static_cast<__uint128_t>(limbs[i]) * a.limbs[j] +
+                            wide[i + j] + carry;
+            wide[i + j] = static_cast<uint64_t>(t);
+            carry = static_cast<uint64_t>(t >> 64);
+        }
+        wide[i + NUM_LIMBS] = carry;
+    }
+
+    // 2^3072 == MAX_PRIME_DIFF (mod p): fold the high half into the low half
+    uint64_t carry = 0;
+    for (size_t i = 0; i < NUM_LIMBS; ++i) {
+        __uint128_t t = static_cast<__uint128_t>(wide[i + NUM_LIMBS]) * MAX_PRIME_DIFF +
+                        wide[i] + carry;
+        limbs[i] = static_cast<uint64_t>(t);
+        carry = static_cast<uint64_t>(t >> 64);
+    }
+
+    // Fold the remaining carry (< 2^22) the same way until nothing is left
+    uint64_t extra = carry * MAX_PRIME_DIFF;
+    while (extra) {
+        for (size_t i = 0; i < NUM_LIMBS && extra; ++i) {
+            limbs[i] += extra;
+            extra = limbs[i] < extra ? 1 : 0;
+        }
+        if (extra) extra = MAX_PRIME_DIFF;
+    }
+
+    if (IsOverflow()) FullReduce();
+}
+
+Num3072 Num3072::GetInverse() const {
+    // Fermat: a^-1 == a^(p-2). The exponent's limbs are all ones except the
+    // lowest, which is 2^64 - MAX_PRIME_DIFF - 2.
+    Num3072 result;
+    for (size_t i = NUM_LIMBS; i-- > 0; ) {
+        uint64_t e = (i == 0) ? ~uint64_t(0) - MAX_PRIME_DIFF - 1 : ~uint64_t(0);
+        for (int bit = 63; bit >= 0; --bit) {
+            result.Multiply(result);
+            if ((e >> bit) & 1) {
+                result.Multiply(*this);
+            }
+        }
+    }
+    return result;
+}
+
+void Num3072::Divide(const Num3072& a) {
+    Multiply(a.GetInverse());
+}
+
+void Num3072::ToBytes(Byte (&out)[BYTE_SIZE]) const {
+    Num3072 reduced = *this;
+    if (reduced.IsOverflow()) reduced.FullReduce();
+    for (size_t i = 0; i < NUM_LIMBS; ++i) {
+        for (size_t j = 0; j < 8; ++j) {
+            out[i * 8 + j] = static_cast<Byte>(reduced.limbs[i] >> (j * 8));
+        }
+    }
+}
+
+// ============================================================================
+// MuHash3072
+// ============================================================================
+
+Num3072 MuHash3072::ToNum3072(const Byte* data, size_t len) {
+    // Expand SHA256(data) to 384 bytes with a counter-mode SHA256 stream
+    Byte seed[SHA256::OUTPUT_SIZE];
+    SHA256().Write(data, len).Finalize(seed);
+
+    Byte expanded[Num3072::BYTE_SIZE];
+    for (size_t i = 0; i < EXPAND_BLOCKS; ++i) {
+        Byte counter[4] = {
+            static_cast<Byte>(i), static_cast<Byte>(i >> 8),
+            static_cast<Byte>(i >> 16), static_cast<Byte>(i >> 24)
+        };
+        SHA256()
+            .Write(seed, sizeof(seed))
+            .Write(counter, sizeof(counter))
+            .Finalize(expanded + i * SHA256::OUTPUT_SIZE);
+    }
+    return Num3072(expanded);
+}
+
+MuHash3072::MuHash3072(const Byte* data, size_t len)
+    : numerator_(ToNum3072(data, len)) {}
+
+MuHash3072& MuHash3072::Insert(const Byte* data, size_t len) {
+    numerator_.Multiply(ToNum3072(data, len));
+    return *this;
+}
+
+MuHash3072& MuHash3072::Remove(const Byte* data, size_t len) {
+    denominator_.Multiply(ToNum3072(data, len));
+    return *this;
+}
+
+MuHash3072& MuHash3072::operator*=(const MuHash3072& mul) {
+    numerator_.Multiply(mul.numerator_);
+    denominator_.Multiply(mul.denominator_);
+    return *this;
+}
+
+MuHash3072& MuHash3072::operator/=(const MuHash3072& div) {
+    numerator_.Multiply(div.denominator_);
+    denominator_.Multiply(div.numerator_);
+    return *this;
+}
+
+Hash256 MuHash3072::Finalize() const {
+    Num3072 value = numerator_;
+    value.Divide(denominator_);
+
+    Byte bytes[Num3072::BYTE_SIZE];
+    value.ToBytes(bytes);
+    return SHA256Hash(bytes, sizeof(bytes));
+}
+
+bool MuHash3072::operator==(const MuHash3072& other) const {
+    Num3072 lhs = numerator_;
+    lhs.Multiply(other.denominator_);
+    Num3072 rhs = other.numerator_;
+    rhs.Multiply(denominator_);
+
+    Byte lhsBytes[Num3072::BYTE_SIZE];
+    Byte rhsBytes[Num3072::BYTE_SIZE];
+    lhs.ToBytes(lhsBytes);
+    rhs.ToBytes(rhsBytes);
+    return std::memcmp(lhsBytes, rhsBytes, sizeof(lhsBytes)) == 0;
+}
+
+} // namespace shurium
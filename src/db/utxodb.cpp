@@ -109,6 +109,41 @@ size_t CoinsViewDB::EstimateSize() const {
     return diskUsage / 50;
 }
 
+std::optional<UTXOCommitment> CoinsViewDB::GetUTXOCommitment(const BlockHash& block) const {
+    if (!db_) {
+        return std::nullopt;
+    }
+    
+    std::string key = MakeKey(prefix::UTXO_COMMITMENT, block);
+    std::string value;
+    Status s = db_->Get(ReadOptions(), Slice(key), &value);
+    
+    if (!s.ok()) {
+        return std::nullopt;
+    }
+    
+    UTXOCommitment commitment;
+    if (!DeserializeFromString(value, commitment)) {
+        return std::nullopt;
+    }
+    
+    return commitment;
+}
+
+bool CoinsViewDB::WriteUTXOCommitment(const BlockHash& block, const UTXOCommitment& commitment) {
+    if (!db_) {
+        return false;
+    }
+    
+    std::string key = MakeKey(prefix::UTXO_COMMITMENT, block);
+    std::string value = SerializeToString(commitment);
+    
+    ++nWrites_;
+    nWriteBytes_ += value.size();
+    
+    return db_->Put(WriteOptions(), Slice(key), Slice(value)).ok();
+}
+
 bool CoinsViewDB::BatchWrite(CoinsMap& mapCoins, const BlockHash& hashBlock) {
     if (!db_) {
         return false;
@@ -241,11 +276,26 @@ Hash256 CalculateUTXOSetHash(const CoinsViewDB& coinsView) {
     return result;
 }
 
+MuHash3072 CalculateUTXOSetMuHash(const CoinsViewDB& coinsView) {
+    MuHash3072 muhash;
+    
+    coinsView.ForEachCoin([&muhash](const OutPoint& outpoint, const Coin& coin) {
+        DataStream ss;
+        Serialize(ss, outpoint);
+        Serialize(ss, coin);
+        muhash.Insert(ss.data(), ss.size());
+        return true;
+    });
+    
+    return muhash;
+}
+
 UTXOStats GetUTXOStats(const CoinsViewDB& coinsView) {
     UTXOStats stats;
     stats.Reset();
     
     SHA256 hasher;
+    MuHash3072 muhash;
     
     std::map<TxHash, uint32_t> txCount;  // Count outputs per transaction
     
@@ -262,8 +312,9 @@ UTXOStats GetUTXOStats(const CoinsViewDB& coinsView) {
         Serialize(ss, coin);
         stats.nBogoSize += ss.size();
         
-        // Update hash
+        // Update hashes
         hasher.Write(ss.data(), ss.size());
+        muhash.Insert(ss.data(), ss.size());
         
         return true;
     });
@@ -271,6 +322,7 @@ UTXOStats GetUTXOStats(const CoinsViewDB& coinsView) {
     stats.nTransactions = txCount.size();
     stats.nDiskSize = coinsView.GetDiskUsage();
     hasher.Finalize(stats.hashSerialized.data());
+    stats.hashMuHash = muhash.Finalize();
     
     return stats;
 }
@@ -507,6 +507,18 @@ void RPCCommandTable::RegisterBlockchainCommands() {
         {}
     });
     
+    commands_.push_back({
+        "gettxoutsetinfo",
+        Category::BLOCKCHAIN,
+        "Returns statistics about the unspent transaction output set.",
+        [table](const RPCRequest& req, const RPCContext& ctx) {
+            return cmd_gettxoutsetinfo(req, ctx, table);
+        },
+        false, false,
+        {},
+        {}
+    });
+    
     commands_.push_back({
         "getmempoolinfo",
         Category::BLOCKCHAIN,
@@ -2189,6 +2201,33 @@ RPCResponse cmd_getdifficulty(const RPCRequest& req, const RPCContext& ctx,
     return RPCResponse::Success(JSONValue(difficulty), req.GetId());
 }
 
+RPCResponse cmd_gettxoutsetinfo(const RPCRequest& req, const RPCContext& ctx,
+                                RPCCommandTable* table) {
+    ChainState* chainState = table->GetChainState();
+    if (!chainState) {
+        return RPCError(-1, "Chain state not available", req.GetId());
+    }
+    
+    // The commitment is rolled forward in ConnectBlock, so this is O(1)
+    // and never touches the coins database
+    auto commitment = chainState->GetUTXOCommitment();
+    if (!commitment) {
+        return RPCError(-1, "UTXO set commitment not available, reindex required", req.GetId());
+    }
+    
+    JSONValue::Object result;
+    BlockIndex* tip = chainState->GetTip();
+    result["height"] = static_cast<int64_t>(tip ? tip->nHeight : -1);
+    result["bestblock"] = tip ? BlockHashToHex(tip->GetBlockHash()) :
+        "0000000000000000000000000000000000000000000000000000000000000000";
+    result["txouts"] = static_cast<int64_t>(commitment->nTransactionOutputs);
+    result["bogosize"] = static_cast<int64_t>(commitment->nBogoSize);
+    result["muhash"] = commitment->GetHash().ToHex();
+    result["total_amount"] = FormatAmount(commitment->nTotalAmount);
+    
+    return RPCResponse::Success(JSONValue(std::move(result)), req.GetId());
+}
+
 RPCResponse cmd_getmempoolinfo(const RPCRequest& req, const RPCContext& ctx,
                                RPCCommandTable* table) {
     JSONValue::Object result;
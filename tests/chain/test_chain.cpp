@@ -646,6 +646,57 @@ TEST_F(ChainStateManagerTest, ChainOfHeaders) {
     EXPECT_EQ(manager->GetBestHeader(), lastIndex);
 }
 
+TEST_F(ChainStateManagerTest, UTXOCommitmentFollowsConnectAndDisconnect) {
+    ChainState& chainstate = manager->GetActiveChainState();
+    auto initial = chainstate.GetUTXOCommitment();
+    ASSERT_TRUE(initial.has_value());
+    EXPECT_EQ(initial->nTransactionOutputs, 0u);
+    
+    Block block;
+    block.nVersion = 1;
+    block.nTime = 1700000000;
+    block.nBits = 0x207fffff;
+    
+    MutableTransaction coinbase;
+    Script coinbaseScript;
+    coinbaseScript << std::vector<uint8_t>{0x04, 0x01};
+    coinbase.vin.push_back(TxIn(OutPoint(), coinbaseScript));
+    Hash160 pubKeyHash;
+    coinbase.vout.push_back(TxOut(50 * COIN, Script::CreateP2PKH(pubKeyHash)));
+    coinbase.vout.push_back(TxOut(1 * COIN, Script::CreateP2PKH(pubKeyHash)));
+    block.vtx.push_back(MakeTransactionRef(std::move(coinbase)));
+    block.hashMerkleRoot = block.ComputeMerkleRoot();
+    
+    BlockIndex* pindex = manager->ProcessBlockHeader(block.GetBlockHeader());
+    ASSERT_NE(pindex, nullptr);
+    
+    BlockUndo undo;
+    ASSERT_EQ(chainstate.ConnectBlock(block, pindex, undo), ConnectResult::OK);
+    
+    auto connected = chainstate.GetUTXOCommitment();
+    ASSERT_TRUE(connected.has_value());
+    EXPECT_EQ(connected->nTransactionOutputs, 2u);
+    EXPECT_EQ(connected->nTotalAmount, 51 * COIN);
+    
+    // Matches a from-scratch commitment of the same coins
+    UTXOCommitment expected;
+    TxHash txid = block.vtx[0]->GetHash();
+    expected.AddCoin(OutPoint(txid, 0), Coin(block.vtx[0]->vout[0], 0, true));
+    expected.AddCoin(OutPoint(txid, 1), Coin(block.vtx[0]->vout[1], 0, true));
+    EXPECT_EQ(connected->GetHash(), expected.GetHash());
+    
+    // Persisted per block in the backing view
+    auto stored = coinsDB->GetUTXOCommitment(pindex->GetBlockHash());
+    ASSERT_TRUE(stored.has_value());
+    EXPECT_EQ(stored->GetHash(), expected.GetHash());
+    
+    ASSERT_EQ(chainstate.DisconnectTip(block, undo), ConnectResult::OK);
+    auto disconnected = chainstate.GetUTXOCommitment();
+    ASSERT_TRUE(disconnected.has_value());
+    EXPECT_EQ(disconnected->nTransactionOutputs, 0u);
+    EXPECT_EQ(disconnected->GetHash(), initial->GetHash());
+}
+
 // ============================================================================
 // BlockUndo Tests
 // ============================================================================
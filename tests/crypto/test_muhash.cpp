@@ -0,0 +1,133 @@
+// SHURIUM - MuHash3072 Tests
+// Copyright (c) 2024 SHURIUM Developers
+// MIT License
+
+#include <gtest/gtest.h>
+#include "shurium/crypto/muhash.h"
+#include "shurium/core/serialize.h"
+
+#include <string>
+#include <vector>
+
+namespace shurium {
+namespace test {
+
+namespace {
+
+std::vector<Byte> Element(uint8_t tag) {
+    return std::vector<Byte>(32, tag);
+}
+
+MuHash3072 FromElements(const std::vector<uint8_t>& tags) {
+    MuHash3072 muhash;
+    for (uint8_t tag : tags) {
+        auto e = Element(tag);
+        muhash.Insert(e.data(), e.size());
+    }
+    return muhash;
+}
+
+} // namespace
+
+// ============================================================================
+// Num3072 Tests
+// ============================================================================
+
+TEST(Num3072Test, InverseRoundTrip) {
+    Byte data[Num3072::BYTE_SIZE];
+    for (size_t i = 0; i < sizeof(data); ++i) {
+        data[i] = static_cast<Byte>(i * 7 + 3);
+    }
+    Num3072 a(data);
+    
+    Num3072 product = a;
+    product.Multiply(a.GetInverse());
+    
+    Byte out[Num3072::BYTE_SIZE];
+    product.ToBytes(out);
+    EXPECT_EQ(out[0], 1);
+    for (size_t i = 1; i < sizeof(out); ++i) {
+        EXPECT_EQ(out[i], 0) << "byte " << i;
+    }
+}
+
+TEST(Num3072Test, ReducesModulus) {
+    // p = 2^3072 - 1103717 must reduce to zero
+    Byte data[Num3072::BYTE_SIZE];
+    std::fill(std::begin(data), std::end(data), 0xFF);
+    uint64_t low = ~uint64_t(0) - 1103717 + 1;
+    for (size_t j = 0; j < 8; ++j) {
+        data[j] = static_cast<Byte>(low >> (j * 8));
+    }
+    
+    Byte out[Num3072::BYTE_SIZE];
+    Num3072(data).ToBytes(out);
+    for (size_t i = 0; i < sizeof(out); ++i) {
+        EXPECT_EQ(out[i], 0) << "byte " << i;
+    }
+}
+
+// ============================================================================
+// MuHash3072 Tests
+// ============================================================================
+
+TEST(MuHashTest, EmptySetIsStable) {
+    EXPECT_EQ(MuHash3072().Finalize(), MuHash3072().Finalize());
+    EXPECT_EQ(MuHash3072(), MuHash3072());
+}
+
+TEST(MuHashTest, OrderIndependent) {
+    MuHash3072 a = FromElements({1, 2, 3});
+    MuHash3072 b = FromElements({3, 1, 2});
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(a.Finalize(), b.Finalize());
+}
+
+TEST(MuHashTest, DifferentSetsDiffer) {
+    EXPECT_NE(FromElements({1, 2}).Finalize(), FromElements({1, 3}).Finalize());
+    EXPECT_NE(FromElements({1}), FromElements({1, 1}));
+}
+
+TEST(MuHashTest, RemoveUndoesInsert) {
+    MuHash3072 muhash = FromElements({1, 2});
+    auto e = Element(3);
+    muhash.Insert(e.data(), e.size());
+    muhash.Remove(e.data(), e.size());
+    EXPECT_EQ(muhash.Finalize(), FromElements({1, 2}).Finalize());
+    
+    // Removal before insertion gives the same result
+    MuHash3072 reordered;
+    reordered.Remove(e.data(), e.size());
+    reordered *= FromElements({1, 2, 3});
+    EXPECT_EQ(reordered, FromElements({1, 2}));
+}
+
+TEST(MuHashTest, UnionAndDifference) {
+    MuHash3072 a = FromElements({1, 2});
+    MuHash3072 b = FromElements({3});
+    
+    MuHash3072 u = a;
+    u *= b;
+    EXPECT_EQ(u, FromElements({1, 2, 3}));
+    
+    u /= b;
+    EXPECT_EQ(u, a);
+}
+
+TEST(MuHashTest, SerializeRoundTrip) {
+    MuHash3072 muhash = FromElements({5, 6});
+    auto e = Element(5);
+    muhash.Remove(e.data(), e.size());
+    
+    DataStream ss;
+    Serialize(ss, muhash);
+    EXPECT_EQ(ss.size(), 2 * Num3072::BYTE_SIZE);
+    
+    MuHash3072 restored;
+    Unserialize(ss, restored);
+    EXPECT_EQ(restored, muhash);
+    EXPECT_EQ(restored.Finalize(), FromElements({6}).Finalize());
+}
+
+} // namespace test
+} // namespace shurium